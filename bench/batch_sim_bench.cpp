@@ -0,0 +1,103 @@
+/*
+* Compares batch_sim against plain logic::is_playable/compare calls.
+* Build from the repository root, e.g.:
+* g++ -O2 -mavx2 -Isrc bench/batch_sim_bench.cpp src/batch_sim.cpp src/logic.cpp -o batch_sim_bench
+*/
+#include "logic.h"
+#include "batch_sim.h"
+#include <chrono>
+#include <vector>
+
+// plays one random player through a logic object, with the same random numbers batch_sim uses
+// returns the number of shape pairs the player revealed
+int play_with_logic(logic &game_logic, uint32_t rng, int max_steps) {
+	int matched = 0;
+	int turns = 0;
+	int firstx = -1, firsty = -1;
+	for (int step = 0; step < max_steps && !game_logic.done(matched); step++) {
+		rng ^= rng << 13;
+		rng ^= rng >> 17;
+		rng ^= rng << 5;
+		int cell = static_cast<int>(((rng >> 8) * 25) >> 24);
+		int x = cell % 5;
+		int y = cell / 5;
+		if (game_logic.is_playable(x, y)) {
+			game_logic.set_played(x, y, true);
+			Shape shape = game_logic.get_shape(x, y);
+			if (shape != Shape::null) {
+				if (firstx < 0) {
+					firstx = x;
+					firsty = y;
+				}
+				else {
+					turns++;
+					if (game_logic.compare(x, y, game_logic.get_shape(firstx, firsty))) {
+						matched++;
+					}
+					else {
+						game_logic.set_played(x, y, false);
+						game_logic.set_played(firstx, firsty, false);
+					}
+					firstx = -1;
+				}
+			}
+		}
+	}
+	return turns;
+}
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv) {
+	int num_players = argc > 1 ? atoi(argv[1]) : 4096;
+	int max_steps = 100000;
+	unsigned int seed = 42;
+
+	srand(seed);
+	logic game_logic;
+	game_logic.reset();
+	game_logic.random_create(12);
+
+	batch_sim vectorized(game_logic, num_players, seed);
+	batch_sim scalar(game_logic, num_players, seed);
+
+	auto start = std::chrono::steady_clock::now();
+	int vector_steps = vectorized.run(max_steps);
+	double vector_time = seconds_since(start);
+
+	start = std::chrono::steady_clock::now();
+	int scalar_steps = 0;
+	int playing = num_players;
+	while (scalar_steps < max_steps && playing > 0) {
+		playing = scalar.step_scalar();
+		scalar_steps++;
+	}
+	double scalar_time = seconds_since(start);
+
+	// replay every player with the random number generator state batch_sim gave it
+	start = std::chrono::steady_clock::now();
+	std::vector<int> logic_turns(num_players);
+	for (int i = 0; i < num_players; i++) {
+		logic player_logic = game_logic;
+		logic_turns[i] = play_with_logic(player_logic, batch_sim::player_seed(seed, i), max_steps);
+	}
+	double logic_time = seconds_since(start);
+
+	int mismatches = 0;
+	for (int i = 0; i < num_players; i++) {
+		if (vectorized.get_turns(i) != scalar.get_turns(i) || vectorized.get_turns(i) != logic_turns[i]) {
+			mismatches++;
+		}
+	}
+
+	double clicks = static_cast<double>(vector_steps) * num_players;
+	std::cout << num_players << " players, " << vector_steps << " steps (" << scalar_steps << " scalar)\n";
+	std::cout << "logic calls: " << logic_time << " s\n";
+	std::cout << "scalar:      " << scalar_time << " s (" << clicks / scalar_time / 1e6 << " M clicks/s)\n";
+	std::cout << (batch_sim::is_vectorized() ? "AVX2:        " : "step():      ") << vector_time << " s (" << clicks / vector_time / 1e6 << " M clicks/s)\n";
+	std::cout << "speedup over logic calls: " << logic_time / vector_time << "x\n";
+	std::cout << "players with different results: " << mismatches << "\n";
+	return mismatches == 0 ? 0 : 1;
+}
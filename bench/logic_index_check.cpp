@@ -0,0 +1,132 @@
+/*
+* Checks logic's index of seen shapes against a scan of the board.
+* Plays random seeded games and, before every click, compares get_known_pair_count, get_known_pair
+* and get_hint with what a full scan of the seen boxes says.
+* Build from the repository root, e.g.:
+* g++ -O2 -Isrc bench/logic_index_check.cpp src/logic.cpp -o logic_index_check
+*/
+#include "logic.h"
+
+// what the player has seen so far, tracked outside of logic
+struct board_scan {
+	bool seen[25]; // revealed at least once
+	bool gone[25]; // matched, or an empty box that was clicked
+};
+
+// returns true if (x1, y1) and (x2, y2) are two different seen, unmatched boxes with the same shape
+bool is_known_pair(logic &game_logic, board_scan &scan, int x1, int y1, int x2, int y2) {
+	int a = y1 * 5 + x1;
+	int b = y2 * 5 + x2;
+	if (a == b || !scan.seen[a] || !scan.seen[b] || scan.gone[a] || scan.gone[b]) {
+		return false;
+	}
+	return game_logic.get_shape(x1, y1) == game_logic.get_shape(x2, y2);
+}
+
+// compares logic's answers with a scan of the board
+// firstx/firsty is the first shape of the current pair, -1 if none is revealed
+// returns false and prints what's wrong on mismatch
+bool check_index(logic &game_logic, board_scan &scan, int firstx, int firsty, unsigned int seed, int step) {
+	int seen_count[7] = {0};
+	for (int cell = 0; cell < 25; cell++) {
+		if (scan.seen[cell] && !scan.gone[cell]) {
+			seen_count[static_cast<int>(game_logic.get_shape(cell % 5, cell / 5))]++;
+		}
+	}
+	int known_pairs = 0;
+	for (int shape = 1; shape < 7; shape++) {
+		known_pairs += seen_count[shape] / 2;
+	}
+
+	if (game_logic.get_known_pair_count() != known_pairs) {
+		std::cout << "seed " << seed << ", step " << step << ": " << game_logic.get_known_pair_count()
+			<< " known pairs, the board has " << known_pairs << "\n";
+		return false;
+	}
+
+	int x1, y1, x2, y2;
+	bool found = game_logic.get_known_pair(x1, y1, x2, y2);
+	if (found != (known_pairs > 0) || (found && !is_known_pair(game_logic, scan, x1, y1, x2, y2))) {
+		std::cout << "seed " << seed << ", step " << step << ": get_known_pair doesn't match the board\n";
+		return false;
+	}
+
+	found = game_logic.get_hint(x1, y1, x2, y2);
+	bool expected = known_pairs > 0;
+	if (firstx >= 0) {
+		// only the first shape's partner may be suggested
+		expected = seen_count[static_cast<int>(game_logic.get_shape(firstx, firsty))] >= 2;
+	}
+	if (found != expected || (found && !is_known_pair(game_logic, scan, x1, y1, x2, y2))
+		|| (found && firstx >= 0 && (x1 != firstx || y1 != firsty))) {
+		std::cout << "seed " << seed << ", step " << step << ": get_hint doesn't match the board\n";
+		return false;
+	}
+	return true;
+}
+
+// plays one game with random clicks, checking the index before every click
+// returns false on the first mismatch
+bool check_game(unsigned int seed, int max_steps) {
+	logic game_logic;
+	game_logic.reset();
+	game_logic.random_create(12, seed);
+	board_scan scan = {};
+	unsigned int rng = seed * 2654435761u | 1;
+	int matched = 0;
+	int firstx = -1, firsty = -1;
+	for (int step = 0; step < max_steps && !game_logic.done(matched); step++) {
+		if (!check_index(game_logic, scan, firstx, firsty, seed, step)) {
+			return false;
+		}
+
+		rng ^= rng << 13;
+		rng ^= rng >> 17;
+		rng ^= rng << 5;
+		int cell = rng % 25;
+		int x = cell % 5;
+		int y = cell / 5;
+		if (!game_logic.is_playable(x, y)) {
+			continue;
+		}
+		game_logic.set_played(x, y, true);
+		Shape shape = game_logic.get_shape(x, y);
+		// an empty box stays unplayable
+		if (shape == Shape::null) {
+			scan.gone[cell] = true;
+			continue;
+		}
+		scan.seen[cell] = true;
+
+		if (firstx < 0) {
+			firstx = x;
+			firsty = y;
+			continue;
+		}
+		if (game_logic.compare(x, y, game_logic.get_shape(firstx, firsty))) {
+			matched++;
+			scan.gone[cell] = true;
+			scan.gone[firsty * 5 + firstx] = true;
+		}
+		else {
+			game_logic.set_played(x, y, false);
+			game_logic.set_played(firstx, firsty, false);
+		}
+		firstx = -1;
+	}
+	return check_index(game_logic, scan, firstx, firsty, seed, max_steps);
+}
+
+int main(int argc, char **argv) {
+	int num_games = argc > 1 ? atoi(argv[1]) : 10000;
+	int max_steps = 5000;
+
+	int failures = 0;
+	for (int i = 0; i < num_games; i++) {
+		if (!check_game(i, max_steps)) {
+			failures++;
+		}
+	}
+	std::cout << num_games << " games, " << failures << " with a mismatch\n";
+	return failures == 0 ? 0 : 1;
+}
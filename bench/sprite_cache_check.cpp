@@ -0,0 +1,86 @@
+/*
+* Checks sprite_cache's hits, misses and eviction order against a plain least recently used list.
+* Runs at every capacity from 1 to N with random IDs from a range much bigger than the hash table,
+* so many IDs share a table position and lookups, inserts and erases go through long probe sequences.
+* Sprites are drawn into memory bitmaps, so no display is needed.
+* Build from the repository root, e.g.:
+* g++ -O2 -Isrc bench/sprite_cache_check.cpp src/sprite_cache.cpp src/shape_catalog.cpp -o sprite_cache_check $(pkg-config --libs allegro-5 allegro_font-5 allegro_primitives-5)
+*/
+#include "sprite_cache.h"
+#include <allegro5/allegro_primitives.h>
+#include <iostream>
+#include <list>
+#include <map>
+#include <stdlib.h>
+
+// requests random IDs from a cache with the given capacity and compares every answer with the model
+// returns false and prints what's wrong on mismatch
+bool check_capacity(int capacity, int requests) {
+	sprite_cache cache(capacity, 8, NULL);
+	std::list<int> recent; // cached IDs, most recent first
+	std::map<int, ALLEGRO_BITMAP *> sprites; // sprite of every cached ID
+	int misses = 0;
+	int num_ids = capacity * 8 + 4;
+	srand(capacity);
+	for (int i = 0; i < requests; i++) {
+		int id = 1 + rand() % num_ids;
+		ALLEGRO_BITMAP *sprite = cache.get(id);
+
+		bool hit = false;
+		for (std::list<int>::iterator it = recent.begin(); it != recent.end(); ++it) {
+			if (*it == id) {
+				recent.erase(it);
+				hit = true;
+				break;
+			}
+		}
+		if (hit) {
+			// a hit returns the sprite the shape was drawn into
+			if (sprite != sprites[id]) {
+				std::cout << "capacity " << capacity << ", request " << i << ": ID " << id << " came back in a different slot\n";
+				return false;
+			}
+		}
+		else {
+			misses++;
+			// a miss in a full cache replaces the least recently used sprite
+			if (static_cast<int>(recent.size()) == capacity) {
+				int evicted = recent.back();
+				recent.pop_back();
+				if (sprite != sprites[evicted]) {
+					std::cout << "capacity " << capacity << ", request " << i << ": ID " << id << " didn't replace ID " << evicted << "\n";
+					return false;
+				}
+				sprites.erase(evicted);
+			}
+		}
+		recent.push_front(id);
+		sprites[id] = sprite;
+
+		if (cache.get_misses() != misses) {
+			std::cout << "capacity " << capacity << ", request " << i << ": " << cache.get_misses() << " misses, expected " << misses << "\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+	int max_capacity = argc > 1 ? atoi(argv[1]) : 64;
+	int requests = 20000;
+
+	if (!al_init() || !al_init_primitives_addon()) {
+		std::cout << "Failed to initialize Allegro.\n";
+		return 1;
+	}
+	al_set_new_bitmap_flags(ALLEGRO_MEMORY_BITMAP);
+
+	int failures = 0;
+	for (int capacity = 1; capacity <= max_capacity; capacity++) {
+		if (!check_capacity(capacity, requests)) {
+			failures++;
+		}
+	}
+	std::cout << "capacities 1 - " << max_capacity << ", " << failures << " with a mismatch\n";
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+/*
+* Measures how many game steps per second vec_env handles with random actions.
+* Build from the repository root, e.g.:
+* g++ -O2 -pthread -Isrc bench/vec_env_bench.cpp src/vec_env.cpp src/logic.cpp -o vec_env_bench
+* Usage: ./vec_env_bench [num_envs] [num_threads]
+*/
+#include "vec_env.h"
+#include <chrono>
+
+int main(int argc, char **argv) {
+	int num_envs = argc > 1 ? atoi(argv[1]) : 4096;
+	int num_threads = argc > 2 ? atoi(argv[2]) : 0;
+	int steps_per_episode = 500;
+	int episodes = 20;
+
+	vec_env env(num_envs, num_threads);
+	std::vector<unsigned int> seeds(num_envs);
+	std::vector<int> actions(num_envs);
+	for (int i = 0; i < num_envs; i++) {
+		seeds[i] = i;
+	}
+
+	// actions are generated up front so only the environment is timed
+	std::vector<int> action_table(num_envs * steps_per_episode);
+	unsigned int state = 1;
+	for (size_t i = 0; i < action_table.size(); i++) {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		action_table[i] = state % vec_env::num_cells;
+	}
+
+	double seconds = 0;
+	int games_done = 0;
+	for (int episode = 0; episode < episodes; episode++) {
+		env.reset(seeds.data());
+		auto start = std::chrono::steady_clock::now();
+		for (int step = 0; step < steps_per_episode; step++) {
+			env.step(&action_table[step * num_envs]);
+		}
+		seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		for (int i = 0; i < num_envs; i++) {
+			games_done += env.get_dones()[i];
+			seeds[i] += num_envs;
+		}
+	}
+
+	double steps = static_cast<double>(num_envs) * steps_per_episode * episodes;
+	std::cout << num_envs << " environments, " << steps << " steps in " << seconds << " s\n";
+	std::cout << steps / seconds / 1e6 << " M steps/s\n";
+	std::cout << games_done << " of " << num_envs * episodes << " games finished within " << steps_per_episode << " steps\n";
+	return 0;
+}
@@ -0,0 +1,93 @@
+#include "alloc_tracker.h"
+#include <allegro5/allegro.h>
+#include <stdexcept>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef TRACK_ALLOCATIONS
+
+// number of allocations made so far, updated from any thread (Allegro has its own)
+static std::atomic<long> allocations(0);
+// allocation count at the end of warm-up, -1 while still warming up
+static std::atomic<long> watch_start(-1);
+
+static void *counting_malloc(size_t n, int, const char *, const char *) {
+	allocations++;
+	return malloc(n);
+}
+
+static void counting_free(void *ptr, int, const char *, const char *) {
+	free(ptr);
+}
+
+static void *counting_realloc(void *ptr, size_t n, int, const char *, const char *) {
+	allocations++;
+	return realloc(ptr, n);
+}
+
+static void *counting_calloc(size_t count, size_t n, int, const char *, const char *) {
+	allocations++;
+	return calloc(count, n);
+}
+
+static ALLEGRO_MEMORY_INTERFACE counting_interface = {counting_malloc, counting_free, counting_realloc, counting_calloc};
+
+void *operator new(size_t n) {
+	allocations++;
+	void *ptr = malloc(n ? n : 1);
+	if (!ptr) {
+		throw std::bad_alloc();
+	}
+	return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+	free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+	free(ptr);
+}
+
+void alloc_tracker::install() {
+	al_set_memory_interface(&counting_interface);
+}
+
+bool alloc_tracker::is_enabled() {
+	return true;
+}
+
+long alloc_tracker::get_count() {
+	return allocations;
+}
+
+void alloc_tracker::start_watching() {
+	long not_watching = -1;
+	watch_start.compare_exchange_strong(not_watching, allocations.load());
+}
+
+void alloc_tracker::check() {
+	long start = watch_start;
+	if (start >= 0 && allocations > start) {
+		throw std::runtime_error("Heap allocation during gameplay!");
+	}
+}
+
+#else
+
+void alloc_tracker::install() {}
+
+bool alloc_tracker::is_enabled() {
+	return false;
+}
+
+long alloc_tracker::get_count() {
+	return 0;
+}
+
+void alloc_tracker::start_watching() {}
+
+void alloc_tracker::check() {}
+
+#endif
\ No newline at end of file
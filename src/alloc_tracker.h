@@ -0,0 +1,25 @@
+/*
+* Counts heap allocations so a build can verify that the gameplay loop doesn't allocate once it has warmed up.
+* Both C++ (operator new) and Allegro (al_malloc and friends) allocations are counted.
+* Tracking is only compiled in when TRACK_ALLOCATIONS is defined, e.g. CXXFLAGS=-DTRACK_ALLOCATIONS ./setup.sh linux
+* Otherwise every method is a no-op.
+*/
+class alloc_tracker {
+public:
+	// installs the counting hooks
+	// must be called before al_init() so Allegro's allocations are routed through the tracker
+	static void install();
+
+	// returns true if tracking was compiled in (TRACK_ALLOCATIONS is defined)
+	static bool is_enabled();
+
+	// returns the number of heap allocations made since the program started
+	static long get_count();
+
+	// marks the end of warm-up; any allocation made after this point is considered a failure
+	// only the first call has an effect
+	static void start_watching();
+
+	// throws an exception if a heap allocation was made since start_watching() was called
+	static void check();
+};
\ No newline at end of file
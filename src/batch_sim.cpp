@@ -0,0 +1,192 @@
+#include "batch_sim.h"
+#include "logic.h"
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+batch_sim::batch_sim(logic &game_logic, int num_players, unsigned int seed) {
+	if (num_players < 1) {
+		throw std::invalid_argument("The number of players must be at least 1.");
+	}
+	this->num_players = num_players;
+	total_pairs = game_logic.get_total_pairs();
+	for (int i = 0; i < 32; i++) {
+		shapes[i] = 0;
+	}
+	for (int y = 0; y < 5; y++) {
+		for (int x = 0; x < 5; x++) {
+			shapes[y * 5 + x] = static_cast<int32_t>(game_logic.get_shape(x, y));
+		}
+	}
+
+	// round up to a whole number of vectors
+	int size = (num_players + lanes - 1) / lanes * lanes;
+	rng.resize(size);
+	played.assign(size, 0);
+	first.assign(size, -1);
+	matched.assign(size, 0);
+	turns.assign(size, 0);
+	for (int i = 0; i < size; i++) {
+		rng[i] = player_seed(seed, i);
+		// padding players start out done so they never play
+		if (i >= num_players) {
+			matched[i] = total_pairs;
+		}
+	}
+}
+
+uint32_t batch_sim::player_seed(unsigned int seed, int player) {
+	// spread the seeds out, xorshift32 must never be seeded with 0
+	uint32_t s = seed + player * 0x9e3779b9u;
+	s ^= s >> 16;
+	s *= 0x85ebca6bu;
+	s ^= s >> 13;
+	return s | 1;
+}
+
+int batch_sim::get_num_players() {
+	return num_players;
+}
+
+bool batch_sim::is_vectorized() {
+#ifdef __AVX2__
+	return true;
+#else
+	return false;
+#endif
+}
+
+int batch_sim::step_scalar() {
+	int playing = 0;
+	for (int i = 0; i < num_players; i++) {
+		uint32_t r = rng[i];
+		r ^= r << 13;
+		r ^= r >> 17;
+		r ^= r << 5;
+		rng[i] = r;
+		if (matched[i] == total_pairs) {
+			continue;
+		}
+		// map the top 24 bits of the random number onto a board index
+		int32_t cell = static_cast<int32_t>(((r >> 8) * num_cells) >> 24);
+		int32_t bit = 1 << cell;
+		// clicking an unplayable box does nothing
+		if ((played[i] & bit) == 0) {
+			played[i] |= bit;
+			int32_t shape = shapes[cell];
+			if (shape != 0) {
+				if (first[i] < 0) {
+					first[i] = cell;
+				}
+				else {
+					turns[i]++;
+					if (shapes[first[i]] == shape) {
+						matched[i]++;
+					}
+					else {
+						// hide the pair again
+						played[i] &= ~(bit | (1 << first[i]));
+					}
+					first[i] = -1;
+				}
+			}
+		}
+		if (matched[i] != total_pairs) {
+			playing++;
+		}
+	}
+	return playing;
+}
+
+#ifdef __AVX2__
+int batch_sim::step() {
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i one = _mm256_set1_epi32(1);
+	const __m256i none = _mm256_set1_epi32(-1);
+	const __m256i cells = _mm256_set1_epi32(num_cells);
+	const __m256i pairs = _mm256_set1_epi32(total_pairs);
+	int playing = 0;
+	for (size_t i = 0; i < rng.size(); i += lanes) {
+		__m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&rng[i]));
+		__m256i pl = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&played[i]));
+		__m256i fst = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&first[i]));
+		__m256i mt = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&matched[i]));
+		__m256i tn = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&turns[i]));
+
+		r = _mm256_xor_si256(r, _mm256_slli_epi32(r, 13));
+		r = _mm256_xor_si256(r, _mm256_srli_epi32(r, 17));
+		r = _mm256_xor_si256(r, _mm256_slli_epi32(r, 5));
+		__m256i cell = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_srli_epi32(r, 8), cells), 24);
+		__m256i bit = _mm256_sllv_epi32(one, cell);
+
+		// lanes whose player is still playing and clicked a playable box
+		__m256i active = _mm256_cmpgt_epi32(pairs, mt);
+		__m256i click = _mm256_and_si256(active, _mm256_cmpeq_epi32(_mm256_and_si256(pl, bit), zero));
+		pl = _mm256_or_si256(pl, _mm256_and_si256(click, bit));
+
+		__m256i shape = _mm256_i32gather_epi32(shapes, cell, 4);
+		__m256i reveal = _mm256_andnot_si256(_mm256_cmpeq_epi32(shape, zero), click);
+		__m256i has_first = _mm256_cmpgt_epi32(fst, none);
+		__m256i first_pick = _mm256_andnot_si256(has_first, reveal);
+		__m256i second_pick = _mm256_and_si256(has_first, reveal);
+
+		// first is -1 in lanes without a first shape, so masking it keeps the gather in bounds
+		__m256i first_cell = _mm256_and_si256(fst, has_first);
+		__m256i first_shape = _mm256_i32gather_epi32(shapes, first_cell, 4);
+		__m256i match = _mm256_and_si256(second_pick, _mm256_cmpeq_epi32(first_shape, shape));
+		__m256i miss = _mm256_andnot_si256(match, second_pick);
+
+		// hide mismatched pairs again
+		__m256i pair_bits = _mm256_or_si256(bit, _mm256_sllv_epi32(one, first_cell));
+		pl = _mm256_andnot_si256(_mm256_and_si256(miss, pair_bits), pl);
+		fst = _mm256_blendv_epi8(fst, cell, first_pick);
+		fst = _mm256_blendv_epi8(fst, none, second_pick);
+		// masks are -1 in selected lanes, so subtracting them counts
+		tn = _mm256_sub_epi32(tn, second_pick);
+		mt = _mm256_sub_epi32(mt, match);
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(&rng[i]), r);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(&played[i]), pl);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(&first[i]), fst);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(&matched[i]), mt);
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(&turns[i]), tn);
+
+		int still_playing = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pairs, mt)));
+		while (still_playing) {
+			playing++;
+			still_playing &= still_playing - 1;
+		}
+	}
+	return playing;
+}
+#else
+int batch_sim::step() {
+	return step_scalar();
+}
+#endif
+
+int batch_sim::run(int max_steps) {
+	int steps = 0;
+	int playing = num_players;
+	while (steps < max_steps && playing > 0) {
+		playing = step();
+		steps++;
+	}
+	return steps;
+}
+
+int batch_sim::get_turns(int player) {
+	if (player < 0 || player >= num_players) {
+		throw std::invalid_argument("Player index out of bounds!");
+	}
+
+	return turns[player];
+}
+
+bool batch_sim::is_done(int player) {
+	if (player < 0 || player >= num_players) {
+		throw std::invalid_argument("Player index out of bounds!");
+	}
+
+	return matched[player] == total_pairs;
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <vector>
+#include <stdint.h>
+
+class logic;
+
+/*
+* Plays one board against many random players at once.
+* Player state is stored as structure-of-arrays and every player makes one click per step, in lockstep.
+* When compiled with AVX2 support (e.g. -mavx2), step() advances 8 players per instruction;
+* otherwise it falls back to step_scalar(). Both produce identical results for the same seed.
+*
+* A random player clicks a random box each step. Clicking an unplayable box does nothing,
+* so it wastes the step, just like clicking it in the game.
+*/
+class batch_sim {
+public:
+	// copies the board layout of the given game and creates num_players random players
+	// each player's random number generator is derived from the given seed
+	// throws an exception if num_players < 1
+	batch_sim(logic &game_logic, int num_players, unsigned int seed);
+
+	// returns the number of players
+	int get_num_players();
+
+	// returns the initial random number generator state of the given player for the given seed
+	// lets other code replay exactly the clicks a player makes
+	static uint32_t player_seed(unsigned int seed, int player);
+
+	// returns true if step() uses AVX2 and false if it falls back to step_scalar()
+	static bool is_vectorized();
+
+	// makes every player that hasn't matched all shape pairs yet click once
+	// returns the number of players that are still playing
+	int step();
+
+	// same as step(), one player at a time
+	int step_scalar();
+
+	// calls step() until every player is done or max_steps steps have been taken
+	// returns the number of steps taken
+	int run(int max_steps);
+
+	// returns the number of shape pairs the given player has revealed so far
+	// throws an exception if the player index is out of range (player < 0 || player >= num_players)
+	int get_turns(int player);
+
+	// returns true if the given player has matched all shape pairs
+	// throws an exception if the player index is out of range (player < 0 || player >= num_players)
+	bool is_done(int player);
+private:
+	static const int num_cells = 25; // boxes on the 5 x 5 board
+	static const int lanes = 8; // players per vector
+
+	int32_t shapes[32]; // packed board layout, padded so any cell index can be gathered
+	int32_t total_pairs; // number of shape pairs the board has
+	int num_players; // number of real players (the rest of the arrays is padding)
+
+	// player state, one element per player
+	std::vector<uint32_t> rng; // xorshift32 state
+	std::vector<int32_t> played; // bit i is set if box i is unplayable
+	std::vector<int32_t> first; // board index of the first shape of the current pair, -1 if none
+	std::vector<int32_t> matched; // number of matched shape pairs
+	std::vector<int32_t> turns; // number of shape pairs revealed
+};
\ No newline at end of file
@@ -5,7 +5,13 @@
 #include <allegro5/allegro_native_dialog.h>
 #include "logic.h"
 #include "board.h"
+#include "alloc_tracker.h"
+#include "tournament.h"
+#include "sprite_cache.h"
+#include "shape_catalog.h"
 #include <iostream>
+#include <stdio.h>
+#include <string.h>
 
 // mouse position
 int mx, my;
@@ -23,40 +29,17 @@ void draw_board(board &board);
 * calls logic::compare to see if the shapes match
 * shape_pair_pos is a pointer to an array whose elements are: [first_shape_boardx, first_shape_boardy, second_shape_boardx, second_shape_boardy]
 */
-void get_mouse_input(board &board, logic &game_logic, int *shape_pair_pos, bool &shapes_match, ALLEGRO_TIMER *show_shapes_timer, bool &show_shapes);
+void get_mouse_input(board &board, logic &game_logic, sprite_cache &sprites, int *shape_pair_pos, bool &shapes_match, ALLEGRO_TIMER *show_shapes_timer, bool &show_shapes);
 
 // finds the center of a box in pixels, given its board index
 void get_box_center(int boardx, int boardy, board &board, int &box_centerx, int &box_centery);
 
 /*
 * draws the appropriate shape, given the board index of the box it's in
-* calls logic::get_shape to determine which shape to draw and then calls one of the following draw functions:
-* - draw_octagon
-* - draw_triangle
-* - draw_diamond
-* - draw_rectangle
-* - draw_oval
-* - draw_circle
+* calls logic::get_shape to determine which shape to draw and then blits its sprite from the given sprite cache
+* the sprites are rasterized by shape_catalog::draw
 */
-void draw_objects(int boardx, int boardy, board &board, logic &game_logic);
-
-// draws an octagon centered at the given location
-void draw_octagon(int box_centerx, int box_centery);
-
-// draws a triangle centered at the given location
-void draw_triangle(int box_centerx, int box_centery);
-
-// draws a diamond centered at the given location
-void draw_diamond(int box_centerx, int box_centery);
-
-// draws a rectangle centered at the given location
-void draw_rectangle(int box_centerx, int box_centery);
-
-// draws an oval centered at the given location
-void draw_oval(int box_centerx, int box_centery);
-
-// draws a circle centered at the given location
-void draw_circle(int box_centerx, int box_centery);
+void draw_objects(int boardx, int boardy, board &board, logic &game_logic, sprite_cache &sprites);
 
 // erases a pair of shapes given their board indexes and draws an 'X' over each of their locations
 // shape_pair_pos is a pointer to an array whose elements are: [first_shape_boardx, first_shape_boardy, second_shape_boardx, second_shape_boardy]
@@ -66,18 +49,45 @@ void x_out_shape_pair(int *shape_pair_pos, board &board, logic &game_logic);
 // shape_pair_pos is a pointer to an array whose elements are: [first_shape_boardx, first_shape_boardy, second_shape_boardx, second_shape_boardy]
 void hide_shape_pair(int *shape_pair_pos, board &board, logic &game_logic);
 
+// outlines the boxes of a hinted shape pair, or erases the outlines if erase is true
+// hint_pos is a pointer to an array whose elements are: [first_shape_boardx, first_shape_boardy, second_shape_boardx, second_shape_boardy]
+void draw_hint(int *hint_pos, board &board, bool erase);
+
+// draws every character the game displays with the given font so its glyphs are cached before gameplay starts
+void warm_up_font(ALLEGRO_FONT *font);
+
 // displays "CONCENTRATION" with the given font
 void draw_game_title(ALLEGRO_FONT *font);
 
 // displays the time spent playing in seconds with the given font
+// the text is formatted into a stack buffer, so no memory is allocated
 void draw_timer(ALLEGRO_FONT *font, int time_played);
 
 // displays the number of matched and unmatched shape pairs with the given font
+// the text is formatted into a stack buffer, so no memory is allocated
 void draw_status(ALLEGRO_FONT *font, int &pairs_matched, logic &game_logic);
 
 // displays a "game over" message with the given font when the player wins
 void game_message(bool &game_over, logic &game_logic, int pairs_matched, ALLEGRO_TIMER *timer, ALLEGRO_FONT *font);
 
+/*
+* scripted allocation check, run with: concentration alloc-test
+* plays two turns that don't match, a hint, a turn that matches and a game reset once to warm up,
+* then plays them all again and fails if that allocated any memory
+* returns 0 on success and 1 on failure, or if allocation tracking wasn't compiled in
+*/
+int run_alloc_test(logic &game_logic, board &board, sprite_cache &sprites, ALLEGRO_FONT *font, ALLEGRO_TIMER *timer, ALLEGRO_TIMER *show_shapes_timer);
+
+// plays the turns, hint and reset of run_alloc_test without waiting for events
+void play_scripted_round(logic &game_logic, board &board, sprite_cache &sprites, ALLEGRO_FONT *font, ALLEGRO_TIMER *timer, ALLEGRO_TIMER *show_shapes_timer);
+
+/*
+* shows num_boards games played by bots side by side until the window is closed or escape is pressed
+* creates its own 60 fps timer and registers it with the given event queue
+* throws an exception if the timer or the tournament view can't be created
+*/
+void run_tournament(int num_boards, int width, int height, ALLEGRO_EVENT_QUEUE *event_queue);
+
 // destroys all Allegro objects
 void clean_up(ALLEGRO_DISPLAY *display, ALLEGRO_EVENT_QUEUE *event_queue, ALLEGRO_TIMER *timer, ALLEGRO_TIMER *show_shapes_timer, ALLEGRO_FONT *font);
 
@@ -90,6 +100,29 @@ int main(int argc, char **argv)
     int width = 640;
     int height = 480;
 
+    // tournament mode: concentration tournament [number of boards, 1 - 64]
+    int tournament_boards = 0;
+    if (argc > 1 && strcmp(argv[1], "tournament") == 0) {
+        tournament_boards = 16;
+        if (argc > 2) {
+            char *end;
+            long count = strtol(argv[2], &end, 10);
+            // reject anything that isn't a whole number in range, instead of silently playing something else
+            if (argv[2][0] == '\0' || *end != '\0' || count < 1 || count > 64) {
+                std::cerr << "Usage: concentration tournament [number of boards, 1 - 64]\n";
+                al_show_native_message_box(NULL, "Error!", "Usage: concentration tournament [number of boards, 1 - 64]", 0, 0, ALLEGRO_MESSAGEBOX_ERROR);
+                return -1;
+            }
+            tournament_boards = count;
+        }
+        width = 1024;
+        height = 768;
+    }
+
+    // scripted allocation check: concentration alloc-test
+    bool alloc_test = argc > 1 && strcmp(argv[1], "alloc-test") == 0;
+    int exit_code = 0;
+
     // gameplay variables
     bool done = false; // controls when to quit the program
     bool game_over = false; // controls when the game ends (i.e. the player wins)
@@ -97,6 +130,8 @@ int main(int argc, char **argv)
     bool show_shapes = false; // works together with show_shapes_timer, "disables" mouse input while true
     int pairs_matched = 0;
     int shape_pair_pos[4]; // [first_shape_boardx, first_shape_boardy, second_shape_boardx, second_shape_boardy]
+    bool hint_shown = false; // true while a hint is outlined on the board
+    int hint_pos[4]; // [first_shape_boardx, first_shape_boardy, second_shape_boardx, second_shape_boardy]
     int time_played = 0; // counts seconds played
 
     // Allegro variables
@@ -106,6 +141,9 @@ int main(int argc, char **argv)
     ALLEGRO_TIMER *show_shapes_timer = NULL; // controls how long two shapes appear before they are hidden again
     ALLEGRO_FONT *font = NULL;
 
+    // count heap allocations (only when compiled with TRACK_ALLOCATIONS)
+    alloc_tracker::install();
+
     // check if Allegro can be initialized
     if (!al_init()) {
         al_show_native_message_box(NULL, "Error!", "Allegro has failed to initialize.", 0, 0, ALLEGRO_MESSAGEBOX_ERROR);
@@ -173,6 +211,7 @@ int main(int argc, char **argv)
         clean_up(display, event_queue, timer, show_shapes_timer, font);
         return -1;
     }
+    warm_up_font(font);
 
     // tell Allegro to look for mouse events and send them to the queue
     al_register_event_source(event_queue, al_get_mouse_event_source());
@@ -186,8 +225,32 @@ int main(int argc, char **argv)
 
     srand(time(NULL)); // init RNG
 
+    if (tournament_boards > 0) {
+        try {
+            run_tournament(tournament_boards, width, height, event_queue);
+        }
+        catch (std::exception &e) {
+            al_show_native_message_box(display, "Exception!", e.what(), 0, 0, ALLEGRO_MESSAGEBOX_ERROR);
+        }
+        clean_up(display, event_queue, timer, show_shapes_timer, font);
+        return 0;
+    }
+
     try {
+        // rasterized shapes, rasterize the classic ones now so revealing them never has to
+        sprite_cache sprites(64, board.get_box_width(), font);
+        for (int id = 1; id <= shape_catalog::num_classic; id++) {
+            sprites.get(id);
+        }
         setup_game(game_logic, board, font, time_played, pairs_matched, timer);
+        // the first start of show_shapes_timer while timer is running grows Allegro's list of active timers,
+        // so do it now instead of when the player reveals the first pair
+        al_start_timer(show_shapes_timer);
+        al_stop_timer(show_shapes_timer);
+        if (alloc_test) {
+            exit_code = run_alloc_test(game_logic, board, sprites, font, timer, show_shapes_timer);
+            done = true;
+        }
         while (!done) {
             ALLEGRO_EVENT ev;
             al_wait_for_event(event_queue, &ev);
@@ -202,10 +265,15 @@ int main(int argc, char **argv)
                 if (ev.mouse.button & 1) {
                     // the player can't reveal more shapes if show_shapes == true
                     if (show_shapes == false) {
+                        // the hint goes away once the player makes a move
+                        if (hint_shown) {
+                            draw_hint(hint_pos, board, true);
+                            hint_shown = false;
+                        }
                         // get mouse position
                         mx = ev.mouse.x;
                         my = ev.mouse.y;
-                        get_mouse_input(board, game_logic, shape_pair_pos, shapes_match, show_shapes_timer, show_shapes);
+                        get_mouse_input(board, game_logic, sprites, shape_pair_pos, shapes_match, show_shapes_timer, show_shapes);
                     }
                 }
             }
@@ -215,6 +283,13 @@ int main(int argc, char **argv)
                 case ALLEGRO_KEY_ESCAPE:
                     done = true;
                     break;
+                case ALLEGRO_KEY_H:
+                    // outline a pair the player has already seen both halves of
+                    if (show_shapes == false && game_logic.get_hint(hint_pos[0], hint_pos[1], hint_pos[2], hint_pos[3])) {
+                        draw_hint(hint_pos, board, false);
+                        hint_shown = true;
+                    }
+                    break;
                 }
             }
             if (ev.type == ALLEGRO_EVENT_TIMER) {
@@ -242,6 +317,10 @@ int main(int argc, char **argv)
             game_message(game_over, game_logic, pairs_matched, timer, font);
             al_flip_display();
 
+            // the first frame completes warm-up, after that the game must not allocate memory
+            alloc_tracker::start_watching();
+            alloc_tracker::check();
+
             // wait for the player to decide whether to play again or really end the game
             while (game_over && !done) {
                 al_wait_for_event(event_queue, &ev);
@@ -255,7 +334,9 @@ int main(int argc, char **argv)
                         game_over = false;
                         pairs_matched = 0;
                         time_played = 0;
+                        hint_shown = false;
                         setup_game(game_logic, board, font, time_played, pairs_matched, timer);
+                        alloc_tracker::check();
                         break;
                     case ALLEGRO_KEY_N:
                     case ALLEGRO_KEY_ESCAPE:
@@ -274,7 +355,7 @@ int main(int argc, char **argv)
     // destroy all Allegro objects
     clean_up(display, event_queue, timer, show_shapes_timer, font);
 
-    return 0;
+    return exit_code;
 }
 
 void setup_game(logic &game_logic, board &board, ALLEGRO_FONT *font, int time_played, int pairs_matched, ALLEGRO_TIMER *timer) {
@@ -312,7 +393,7 @@ void draw_board(board &board) {
     }
 }
 
-void get_mouse_input(board &board, logic &game_logic, int *shape_pair_pos, bool &shapes_match, ALLEGRO_TIMER *show_shapes_timer, bool &show_shapes) {
+void get_mouse_input(board &board, logic &game_logic, sprite_cache &sprites, int *shape_pair_pos, bool &shapes_match, ALLEGRO_TIMER *show_shapes_timer, bool &show_shapes) {
     // if mouse is inside the board
     if (mx < board.get_width() && my < board.get_height()) {
         // figure out which box was clicked
@@ -332,13 +413,13 @@ void get_mouse_input(board &board, logic &game_logic, int *shape_pair_pos, bool
                         first_shape = shape;
                         shape_pair_pos[0] = boardx;
                         shape_pair_pos[1] = boardy;
-                        draw_objects(boardx, boardy, board, game_logic);
+                        draw_objects(boardx, boardy, board, game_logic, sprites);
                     }
                     // second shape was selected
                     else {
                         shape_pair_pos[2] = boardx;
                         shape_pair_pos[3] = boardy;
-                        draw_objects(boardx, boardy, board, game_logic);
+                        draw_objects(boardx, boardy, board, game_logic, sprites);
                         shapes_match = game_logic.compare(boardx, boardy, first_shape); // compare the two shapes
                         first_shape = Shape::null; // reset now that two shapes have been checked
                         // show the shapes for 0.5 seconds
@@ -368,33 +449,16 @@ void get_box_center(int boardx, int boardy, board &board, int &box_centerx, int
     }
 }
 
-void draw_objects(int boardx, int boardy, board &board, logic &game_logic) {
+void draw_objects(int boardx, int boardy, board &board, logic &game_logic, sprite_cache &sprites) {
     try {
         // find the center of this box
         int box_centerx, box_centery;
         get_box_center(boardx, boardy, board, box_centerx, box_centery);
         // get the shape in this box
         Shape shape = game_logic.get_shape(boardx, boardy);
-        // draw the shape
-        switch (shape) {
-        case Shape::octagon:
-            draw_octagon(box_centerx, box_centery);
-            break;
-        case Shape::triangle:
-            draw_triangle(box_centerx, box_centery);
-            break;
-        case Shape::diamond:
-            draw_diamond(box_centerx, box_centery);
-            break;
-        case Shape::rectangle:
-            draw_rectangle(box_centerx, box_centery);
-            break;
-        case Shape::oval:
-            draw_oval(box_centerx, box_centery);
-            break;
-        case Shape::circle:
-            draw_circle(box_centerx, box_centery);
-            break;
+        // draw the shape with a single blit
+        if (shape != Shape::null) {
+            sprites.draw(static_cast<int>(shape), box_centerx, box_centery);
         }
     }
     catch (std::exception &e) {
@@ -402,58 +466,6 @@ void draw_objects(int boardx, int boardy, board &board, logic &game_logic) {
     }
 }
 
-void draw_octagon(int box_centerx, int box_centery) {
-    // vertex positions relative to the center of the box
-    int vertex_posx[8] = {0, -14, -20, -14, 0, 14, 20, 14};
-    int vertex_posy[8] = {-20, -14, 0, 14, 20, 14, 0, -14};
-    ALLEGRO_COLOR color = al_map_rgb(255, 0, 0);
-    for (int i = 0; i < 8; i++) {
-        // connect each vertex to the next
-        // when i == 7, connect the first and last vertices
-        int x1 = box_centerx + vertex_posx[i];
-        int y1 = box_centery + vertex_posy[i];
-        int x2 = box_centerx + vertex_posx[(i + 1) % 8];
-        int y2 = box_centery + vertex_posy[(i + 1) % 8];
-        al_draw_line(x1, y1, x2, y2, color, 1);
-    }
-}
-
-void draw_triangle(int box_centerx, int box_centery) {
-    int radius = 20;
-    ALLEGRO_COLOR color = al_map_rgb(255, 255, 0);
-    al_draw_filled_triangle(box_centerx, box_centery - radius, box_centerx - radius, box_centery + radius, box_centerx + radius, box_centery + radius, color);
-}
-
-void draw_diamond(int box_centerx, int box_centery) {
-    int base = 18;
-    int height = 24;
-    ALLEGRO_COLOR color = al_map_rgb(255, 0, 255);
-    al_draw_filled_triangle(box_centerx, box_centery - height, box_centerx - base, box_centery, box_centerx, box_centery, color);
-    al_draw_filled_triangle(box_centerx, box_centery - height, box_centerx + base, box_centery, box_centerx, box_centery, color);
-    al_draw_filled_triangle(box_centerx, box_centery + height, box_centerx - base, box_centery, box_centerx, box_centery, color);
-    al_draw_filled_triangle(box_centerx, box_centery + height, box_centerx + base, box_centery, box_centerx, box_centery, color);
-}
-
-void draw_rectangle(int box_centerx, int box_centery) {
-    int width = 30;
-    int height = 20;
-    ALLEGRO_COLOR color = al_map_rgb(0, 255, 0);
-    al_draw_filled_rectangle(box_centerx - width, box_centery - height, box_centerx + width, box_centery + height, color);
-}
-
-void draw_oval(int box_centerx, int box_centery) {
-    int rx = 30;
-    int ry = 20;
-    ALLEGRO_COLOR color = al_map_rgb(0, 255, 255);
-    al_draw_filled_ellipse(box_centerx, box_centery, rx, ry, color);
-}
-
-void draw_circle(int box_centerx, int box_centery) {
-    int radius = 20;
-    ALLEGRO_COLOR color = al_map_rgb(0, 0, 255);
-    al_draw_filled_circle(box_centerx, box_centery, radius, color);
-}
-
 void x_out_shape_pair(int *shape_pair_pos, board &board, logic &game_logic) {
     try {
         int box_width = board.get_box_width();
@@ -487,6 +499,27 @@ void hide_shape_pair(int *shape_pair_pos, board &board, logic &game_logic) {
     }
 }
 
+void draw_hint(int *hint_pos, board &board, bool erase) {
+    try {
+        int box_width = board.get_box_width();
+        int box_height = board.get_box_height();
+        int box_centerx, box_centery;
+        ALLEGRO_COLOR color = erase ? al_map_rgb(0, 0, 0) : al_map_rgb(255, 255, 0);
+        for (int i = 0; i < 4; i += 2) {
+            get_box_center(hint_pos[i], hint_pos[i + 1], board, box_centerx, box_centery);
+            al_draw_rectangle(box_centerx - box_width / 2 + 4, box_centery - box_height / 2 + 4, box_centerx + box_width / 2 - 4, box_centery + box_height / 2 - 4, color, 2);
+        }
+    }
+    catch (std::exception &e) {
+        throw e;
+    }
+}
+
+void warm_up_font(ALLEGRO_FONT *font) {
+    // drawn off screen, setup_game clears the display afterwards anyway
+    al_draw_text(font, al_map_rgb(0, 0, 0), -1000, -1000, ALLEGRO_ALIGN_LEFT, "0123456789 -!?():/ ABCDEFGHIJKLMNOPQRSTUVWXYZ abcdefghijklmnopqrstuvwxyz");
+}
+
 void draw_game_title(ALLEGRO_FONT *font) {
     int x = 100;
     int y = 430;
@@ -500,13 +533,18 @@ void draw_timer(ALLEGRO_FONT *font, int time_played) {
     int y = 60;
     ALLEGRO_COLOR color = al_map_rgb(255, 255, 255);
     al_draw_filled_rectangle(401, 0, 640, 401, al_map_rgb(0, 0, 255));
-    al_draw_textf(font, color, x, y, ALLEGRO_ALIGN_LEFT, "Time: %i", time_played);
+    char text[32];
+    snprintf(text, sizeof(text), "Time: %i", time_played);
+    al_draw_text(font, color, x, y, ALLEGRO_ALIGN_LEFT, text);
 }
 
 void draw_status(ALLEGRO_FONT *font, int &pairs_matched, logic &game_logic) {
     al_draw_filled_rectangle(401, 401, 640, 480, al_map_rgb(255, 0, 0));
-    al_draw_textf(font, al_map_rgb(255, 255, 255), 440, 415, ALLEGRO_ALIGN_LEFT, "Score: % i", pairs_matched);
-    al_draw_textf(font, al_map_rgb(255, 255, 255), 440, 445, ALLEGRO_ALIGN_LEFT, "Remaining: % i", game_logic.get_total_pairs() - pairs_matched);
+    char text[32];
+    snprintf(text, sizeof(text), "Score: % i", pairs_matched);
+    al_draw_text(font, al_map_rgb(255, 255, 255), 440, 415, ALLEGRO_ALIGN_LEFT, text);
+    snprintf(text, sizeof(text), "Remaining: % i", game_logic.get_total_pairs() - pairs_matched);
+    al_draw_text(font, al_map_rgb(255, 255, 255), 440, 445, ALLEGRO_ALIGN_LEFT, text);
 }
 
 void game_message(bool &game_over, logic &game_logic, int pairs_matched, ALLEGRO_TIMER *timer, ALLEGRO_FONT *font) {
@@ -524,6 +562,138 @@ void game_message(bool &game_over, logic &game_logic, int pairs_matched, ALLEGRO
     }
 }
 
+int run_alloc_test(logic &game_logic, board &board, sprite_cache &sprites, ALLEGRO_FONT *font, ALLEGRO_TIMER *timer, ALLEGRO_TIMER *show_shapes_timer) {
+    if (!alloc_tracker::is_enabled()) {
+        std::cout << "alloc-test: allocation tracking isn't compiled in, build with -DTRACK_ALLOCATIONS\n";
+        return 1;
+    }
+    play_scripted_round(game_logic, board, sprites, font, timer, show_shapes_timer);
+    long before = alloc_tracker::get_count();
+    play_scripted_round(game_logic, board, sprites, font, timer, show_shapes_timer);
+    long allocations = alloc_tracker::get_count() - before;
+    if (allocations > 0) {
+        std::cout << "alloc-test: FAILED, " << allocations << " allocations after warm-up\n";
+        return 1;
+    }
+    std::cout << "alloc-test: passed, no allocations after warm-up\n";
+    return 0;
+}
+
+void play_scripted_round(logic &game_logic, board &board, sprite_cache &sprites, ALLEGRO_FONT *font, ALLEGRO_TIMER *timer, ALLEGRO_TIMER *show_shapes_timer) {
+    int pairs_matched = 0;
+    int time_played = 0;
+    bool game_over = false;
+    bool shapes_match = false;
+    bool show_shapes = false;
+    int shape_pair_pos[4];
+    int hint_pos[4];
+
+    // pick the boxes to click: first and partner hold the same shape, other holds a different one
+    // first and partner are each revealed in a pair that doesn't match, which leaves a known pair for the hint,
+    // then they're clicked together to match
+    int first = -1, other = -1, partner = -1;
+    for (int cell = 0; cell < 25; cell++) {
+        Shape shape = game_logic.get_shape(cell % 5, cell / 5);
+        if (shape == Shape::null) {
+            continue;
+        }
+        if (first == -1) {
+            first = cell;
+        }
+        else if (shape != game_logic.get_shape(first % 5, first / 5)) {
+            other = cell;
+        }
+        else if (partner == -1) {
+            partner = cell;
+        }
+    }
+    int turns[3][2] = {{first, other}, {partner, other}, {first, partner}};
+
+    for (int turn = 0; turn < 3; turn++) {
+        // a board with only one kind of shape has no pair that doesn't match
+        if (turns[turn][1] == -1) {
+            continue;
+        }
+        // reveal both shapes like mouse clicks in the middle of their boxes would
+        for (int i = 0; i < 2; i++) {
+            mx = (turns[turn][i] % 5) * board.get_box_width() + board.get_box_width() / 2;
+            my = (turns[turn][i] / 5) * board.get_box_height() + board.get_box_height() / 2;
+            get_mouse_input(board, game_logic, sprites, shape_pair_pos, shapes_match, show_shapes_timer, show_shapes);
+        }
+        // what the show_shapes_timer event does
+        al_stop_timer(show_shapes_timer);
+        if (shapes_match) {
+            pairs_matched++;
+            x_out_shape_pair(shape_pair_pos, board, game_logic);
+        }
+        else {
+            hide_shape_pair(shape_pair_pos, board, game_logic);
+        }
+        show_shapes = false;
+
+        // after the second turn both shapes of first's pair have been seen, so there's a hint
+        if (game_logic.get_hint(hint_pos[0], hint_pos[1], hint_pos[2], hint_pos[3])) {
+            draw_hint(hint_pos, board, false);
+            draw_hint(hint_pos, board, true);
+        }
+
+        draw_board(board);
+        draw_timer(font, time_played);
+        draw_status(font, pairs_matched, game_logic);
+        game_message(game_over, game_logic, pairs_matched, timer, font);
+        al_flip_display();
+    }
+
+    // what pressing 'y' after a win does
+    setup_game(game_logic, board, font, 0, 0, timer);
+}
+
+void run_tournament(int num_boards, int width, int height, ALLEGRO_EVENT_QUEUE *event_queue) {
+    ALLEGRO_TIMER *frame_timer = al_create_timer(1.0 / 60);
+    // check if timer creation failed
+    if (!frame_timer) {
+        throw std::runtime_error("Failed to create timer.");
+    }
+    try {
+        tournament_view view(num_boards, width, height, time(NULL));
+        al_register_event_source(event_queue, al_get_timer_event_source(frame_timer));
+        al_start_timer(frame_timer);
+        bool done = false;
+        bool redraw = true;
+        while (!done) {
+            ALLEGRO_EVENT ev;
+            al_wait_for_event(event_queue, &ev);
+            if (ev.type == ALLEGRO_EVENT_DISPLAY_CLOSE) {
+                done = true;
+            }
+            else if (ev.type == ALLEGRO_EVENT_KEY_DOWN && ev.keyboard.keycode == ALLEGRO_KEY_ESCAPE) {
+                done = true;
+            }
+            else if (ev.type == ALLEGRO_EVENT_TIMER && ev.timer.source == frame_timer) {
+                view.step();
+                redraw = true;
+            }
+
+            // skip frames instead of falling behind
+            if (redraw && al_is_event_queue_empty(event_queue)) {
+                redraw = false;
+                al_clear_to_color(al_map_rgb(0, 0, 0));
+                view.draw();
+                al_flip_display();
+
+                // the first frame completes warm-up, after that the tournament must not allocate memory
+                alloc_tracker::start_watching();
+                alloc_tracker::check();
+            }
+        }
+    }
+    catch (std::exception &e) {
+        al_destroy_timer(frame_timer);
+        throw;
+    }
+    al_destroy_timer(frame_timer);
+}
+
 void clean_up(ALLEGRO_DISPLAY *display, ALLEGRO_EVENT_QUEUE *event_queue, ALLEGRO_TIMER *timer, ALLEGRO_TIMER *show_shapes_timer, ALLEGRO_FONT *font) {
     al_destroy_display(display);
     al_destroy_event_queue(event_queue);
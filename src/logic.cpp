@@ -3,6 +3,7 @@
 logic::logic() {
 	total_pairs = 0;
 	max_pairs = 12;
+	clear_index();
 }
 
 int logic::get_total_pairs() {
@@ -21,8 +22,21 @@ void logic::set_shape(int x, int y, Shape shape) {
 	if (x < 0 || x > 4 || y < 0 || y > 4) {
 		throw std::invalid_argument("Array index out of bounds!");
 	}
+	if (static_cast<int>(shape) < 0 || static_cast<int>(shape) >= num_shapes) {
+		throw std::invalid_argument("Unknown shape!");
+	}
 
+	// a seen location is indexed under its shape, so move it to the new one
+	// an empty box isn't indexed, just like set_played skips it
+	int cell = y * 5 + x;
+	bool was_seen = seen_pos[cell] != -1;
+	if (was_seen) {
+		forget(cell);
+	}
 	pattern[y][x] = shape;
+	if (was_seen && shape != Shape::null) {
+		remember(cell);
+	}
 }
 
 bool logic::is_playable(int x, int y) {
@@ -39,6 +53,24 @@ void logic::set_played(int x, int y, bool state) {
 	}
 
 	already_played[y][x] = state;
+	int cell = y * 5 + x;
+	if (state) {
+		// revealing an empty box doesn't count as a pick
+		if (pattern[y][x] != Shape::null) {
+			remember(cell);
+			if (first_pick == -1) {
+				first_pick = cell;
+			}
+			else {
+				second_pick = cell;
+			}
+		}
+	}
+	else {
+		// the pair is hidden again
+		first_pick = -1;
+		second_pick = -1;
+	}
 }
 
 bool logic::compare(int x, int y, Shape guess) {
@@ -46,7 +78,15 @@ bool logic::compare(int x, int y, Shape guess) {
 		throw std::invalid_argument("Array index out of bounds!");
 	}
 
-	return pattern[y][x] == guess;
+	bool match = pattern[y][x] == guess;
+	// a matched pair is out of the game, so it's no longer useful as a hint
+	if (match && y * 5 + x == second_pick && first_pick != -1) {
+		forget(first_pick);
+		forget(second_pick);
+	}
+	first_pick = -1;
+	second_pick = -1;
+	return match;
 }
 
 bool logic::done(int pairs_matched) {
@@ -64,24 +104,30 @@ void logic::reset() {
 			already_played[y][x] = false;
 		}
 	}
+	clear_index();
 }
 
 void logic::random_create(int num_pairs) {
+	random_create(num_pairs, rand());
+}
+
+void logic::random_create(int num_pairs, unsigned int seed) {
 	if (num_pairs < 1 || num_pairs > max_pairs) {
 		throw std::invalid_argument("The given number of pairs must be between 1 and 12.");
 	}
 	total_pairs = num_pairs;
+	unsigned int state = seed * 2654435761u + 1;
 	for (int i = 0; i < total_pairs; i++) {
 		// get a random shape
-		Shape shape = static_cast<Shape>(rand() % 6 + 1);
+		Shape shape = static_cast<Shape>(next_random(state) % 6 + 1);
 		// place a pair of this shape
 		for (int j = 0; j < 2; j++) {
 			bool placed = false;
 			// randomly generate an (x, y) board location and
 			// keep looping until we find an empty/available spot
 			do {
-				int x = rand() % 5;
-				int y = rand() % 5;
+				int x = next_random(state) % 5;
+				int y = next_random(state) % 5;
 				if (pattern[y][x] == Shape::null) {
 					pattern[y][x] = shape;
 					placed = true;
@@ -91,6 +137,118 @@ void logic::random_create(int num_pairs) {
 	}
 }
 
+int logic::get_known_pair_count() {
+	return known_pairs;
+}
+
+bool logic::get_known_pair(int &x1, int &y1, int &x2, int &y2) {
+	if (known_count == 0) {
+		return false;
+	}
+
+	int shape = known[0];
+	x1 = seen[shape][0] % 5;
+	y1 = seen[shape][0] / 5;
+	x2 = seen[shape][1] % 5;
+	y2 = seen[shape][1] / 5;
+	return true;
+}
+
+bool logic::find_partner(int x, int y, int &partnerx, int &partnery) {
+	if (x < 0 || x > 4 || y < 0 || y > 4) {
+		throw std::invalid_argument("Array index out of bounds!");
+	}
+
+	int shape = static_cast<int>(pattern[y][x]);
+	if (shape == 0) {
+		return false;
+	}
+	// (x, y) itself is at most one of the entries, so checking two is enough
+	int cell = y * 5 + x;
+	for (int i = 0; i < seen_count[shape] && i < 2; i++) {
+		if (seen[shape][i] != cell) {
+			partnerx = seen[shape][i] % 5;
+			partnery = seen[shape][i] / 5;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool logic::get_hint(int &x1, int &y1, int &x2, int &y2) {
+	// the player has started a pair, only its partner can complete it
+	if (first_pick != -1 && second_pick == -1) {
+		x1 = first_pick % 5;
+		y1 = first_pick / 5;
+		return find_partner(x1, y1, x2, y2);
+	}
+	return get_known_pair(x1, y1, x2, y2);
+}
+
+void logic::clear_index() {
+	for (int shape = 0; shape < num_shapes; shape++) {
+		seen_count[shape] = 0;
+		known_pos[shape] = -1;
+	}
+	for (int cell = 0; cell < 25; cell++) {
+		seen_pos[cell] = -1;
+	}
+	known_count = 0;
+	known_pairs = 0;
+	first_pick = -1;
+	second_pick = -1;
+}
+
+void logic::remember(int cell) {
+	if (seen_pos[cell] != -1) {
+		return;
+	}
+	int shape = static_cast<int>(pattern[cell / 5][cell % 5]);
+	seen_pos[cell] = seen_count[shape];
+	seen[shape][seen_count[shape]++] = cell;
+	// every second location of a shape completes a pair
+	if (seen_count[shape] % 2 == 0) {
+		known_pairs++;
+	}
+	if (seen_count[shape] == 2) {
+		known_pos[shape] = known_count;
+		known[known_count++] = shape;
+	}
+}
+
+void logic::forget(int cell) {
+	if (seen_pos[cell] == -1) {
+		return;
+	}
+	int shape = static_cast<int>(pattern[cell / 5][cell % 5]);
+	if (seen_count[shape] % 2 == 0) {
+		known_pairs--;
+	}
+	if (seen_count[shape] == 2) {
+		// swap the last known shape into this shape's place
+		int last = known[--known_count];
+		known[known_pos[shape]] = last;
+		known_pos[last] = known_pos[shape];
+		known_pos[shape] = -1;
+	}
+	// swap the last seen location of this shape into this location's place
+	int last = seen[shape][--seen_count[shape]];
+	seen[shape][seen_pos[cell]] = last;
+	seen_pos[last] = seen_pos[cell];
+	seen_pos[cell] = -1;
+}
+
+unsigned int logic::next_random(unsigned int &state) {
+	// xorshift32 gets stuck at 0
+	if (state == 0) {
+		state = 1;
+	}
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
 void logic::print_shape(int x, int y) {
 	if (x < 0 || x > 4 || y < 0 || y > 4) {
 		throw std::invalid_argument("Array index out of bounds!");
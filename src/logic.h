@@ -2,7 +2,11 @@
 #include <stdlib.h>
 #include <iostream>
 
-// Handles the game logic
+/*
+* Handles the game logic
+* Besides the board, logic keeps an index of the shapes the player has seen (revealed with set_played) but not matched yet,
+* grouped by shape. The index is updated as boxes are played and compared, so hint queries never scan the board.
+*/
 class logic {
 public:
 	// constructor
@@ -16,7 +20,7 @@ public:
 	Shape get_shape(int x, int y);
 
 	// sets the given shape at the given (x, y) location
-	// throws an exception if either index is out of range (index < 0 || index > 4)
+	// throws an exception if either index is out of range (index < 0 || index > 4) or the shape isn't one from shape.h
 	void set_shape(int x, int y, Shape shape);
 
 	// returns true if the given (x, y) location is playable and false if not
@@ -25,11 +29,16 @@ public:
 
 	// sets the given (x, y) location to a unplayable/playable state
 	// true means the location is unplayable, false means it's playable
+	// making a location with a shape unplayable reveals it: the shape is added to the index of seen shapes
+	// and becomes the first or second shape of the current pair
+	// making a location playable again (hiding a pair) ends the current pair
 	// throws an exception if either index is out of range (index < 0 || index > 4)
 	void set_played(int x, int y, bool state);
 	
 	// compares the shape at the given (x, y) location to the given shape
 	// returns true if the shapes match, false if not
+	// if (x, y) is the second shape of the current pair and the shapes match, both shapes are removed from the index of seen shapes
+	// either way, this ends the current pair
 	// throws an exception if either index is out of range (index < 0 || index > 4)
 	bool compare(int x, int y, Shape shape);
 	
@@ -44,6 +53,29 @@ public:
 	// throws an exception if the given number of pairs is out of range (num_pairs < 1 || num_pairs > max_pairs)
 	void random_create(int num_pairs);
 
+	// same as random_create(num_pairs), but uses its own random number generator seeded with the given seed
+	// the same seed always produces the same board, and this doesn't touch the global rand() state
+	void random_create(int num_pairs, unsigned int seed);
+
+	// returns the number of unmatched shape pairs whose both halves the player has seen
+	int get_known_pair_count();
+
+	// finds an unmatched shape pair whose both halves the player has seen and stores its locations
+	// returns false if there is no such pair
+	bool get_known_pair(int &x1, int &y1, int &x2, int &y2);
+
+	// finds another seen, unmatched location with the same shape as the given (x, y) location and stores it
+	// returns false if there is none (or the location is empty)
+	// throws an exception if either index is out of range (index < 0 || index > 4)
+	bool find_partner(int x, int y, int &partnerx, int &partnery);
+
+	// suggests a pair to play and stores its locations
+	// if the first shape of the current pair is revealed, only suggests it together with its partner,
+	// because any other pair would be a guaranteed mismatch
+	// otherwise suggests any unmatched pair whose both halves the player has seen
+	// returns false if there is nothing to suggest
+	bool get_hint(int &x1, int &y1, int &x2, int &y2);
+
 	// debug methods
 	void print_shape(int x, int y);
 	void print_pattern();
@@ -53,4 +85,27 @@ private:
 	bool already_played[5][5]; // board state
 	int total_pairs; // number of shape pairs the board has
 	int max_pairs; // the maximum number of shape pairs the board can have
+
+	// index of seen, unmatched shapes (locations are stored as board indexes, y * 5 + x)
+	static const int num_shapes = 7; // number of values in Shape, including null
+	int seen[num_shapes][25]; // seen locations of each shape
+	int seen_count[num_shapes]; // number of seen locations of each shape
+	int seen_pos[25]; // position of each location in its shape's seen list, -1 if it isn't in the index
+	int known[num_shapes]; // shapes with at least two seen locations
+	int known_count; // number of shapes in known
+	int known_pos[num_shapes]; // position of each shape in known, -1 if it isn't in there
+	int known_pairs; // number of pairs with both halves seen
+	int first_pick, second_pick; // locations of the current pair, -1 if not revealed yet
+
+	// empties the index of seen shapes and ends the current pair
+	void clear_index();
+
+	// adds the given location to the index of seen shapes
+	void remember(int cell);
+
+	// removes the given location from the index of seen shapes
+	void forget(int cell);
+
+	// advances the given xorshift32 state and returns it
+	static unsigned int next_random(unsigned int &state);
 };
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include "shape_catalog.h"
+#include <allegro5/allegro_primitives.h>
+#include <stdexcept>
+#include <math.h>
+
+shape_style shape_catalog::get_style(int id) {
+	if (id <= num_classic) {
+		throw std::invalid_argument("Only IDs above 6 have generated shapes.");
+	}
+
+	const char glyphs[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+	const int num_glyphs = 36;
+	const int num_outlines = 7; // ellipse and 3 - 8 sided polygons
+	const float pi = 3.14159265f;
+	unsigned int n = id - num_classic - 1;
+
+	shape_style style;
+	// glyph and outline come straight from the ID, so neighboring IDs always look different
+	style.glyph = glyphs[n % num_glyphs];
+	int outline = (n / num_glyphs) % num_outlines;
+	style.sides = outline == 0 ? 0 : outline + 2;
+
+	// everything else comes from a hash of the ID
+	unsigned int hash = n * 2654435761u;
+	hash ^= hash >> 15;
+	hash *= 0x2c1b3c6du;
+	hash ^= hash >> 12;
+	style.rotation = (hash & 0xff) / 256.0f * 2 * pi / (style.sides > 0 ? style.sides : 1);
+	style.stretch = 0.7f + ((hash >> 8) & 0xff) / 256.0f * 0.3f;
+
+	// spread the hues out with the golden ratio, and keep colors light so the glyph stays readable
+	float hue = fmodf(n * 0.618034f, 1.0f) * 6;
+	float saturation = 0.5f + ((hash >> 16) & 0xff) / 256.0f * 0.5f;
+	float rgb[3];
+	for (int i = 0; i < 3; i++) {
+		// distance from this channel's peak on the color wheel
+		float d = fabsf(fmodf(hue - i * 2 + 6, 6.0f) - 3);
+		float channel = fminf(fmaxf(d - 1, 0.0f), 1.0f);
+		rgb[i] = 1 - saturation * (1 - channel);
+	}
+	style.red = static_cast<unsigned char>(rgb[0] * 255);
+	style.green = static_cast<unsigned char>(rgb[1] * 255);
+	style.blue = static_cast<unsigned char>(rgb[2] * 255);
+	return style;
+}
+
+void shape_catalog::draw(int id, int centerx, int centery, int size, ALLEGRO_FONT *font) {
+	if (id < 1) {
+		throw std::invalid_argument("Shape ID out of range!");
+	}
+
+	float scale = static_cast<float>(size) / classic_size;
+	switch (id) {
+	case 1:
+		draw_octagon(centerx, centery, scale);
+		return;
+	case 2:
+		draw_triangle(centerx, centery, scale);
+		return;
+	case 3:
+		draw_diamond(centerx, centery, scale);
+		return;
+	case 4:
+		draw_rectangle(centerx, centery, scale);
+		return;
+	case 5:
+		draw_oval(centerx, centery, scale);
+		return;
+	case 6:
+		draw_circle(centerx, centery, scale);
+		return;
+	}
+
+	shape_style style = get_style(id);
+	ALLEGRO_COLOR color = al_map_rgb(style.red, style.green, style.blue);
+	float radius = size * 0.4f;
+	if (style.sides == 0) {
+		al_draw_filled_ellipse(centerx, centery, radius, radius * style.stretch, color);
+	}
+	else {
+		// the polygons are convex, so a triangle fan around the center fills them
+		// the vertices live on the stack so drawing doesn't allocate
+		ALLEGRO_VERTEX vertices[10];
+		vertices[0].x = centerx;
+		vertices[0].y = centery;
+		for (int i = 0; i <= style.sides; i++) {
+			float angle = style.rotation + i * 2 * 3.14159265f / style.sides;
+			vertices[i + 1].x = centerx + radius * cosf(angle);
+			vertices[i + 1].y = centery + radius * style.stretch * sinf(angle);
+		}
+		for (int i = 0; i < style.sides + 2; i++) {
+			vertices[i].z = 0;
+			vertices[i].u = 0;
+			vertices[i].v = 0;
+			vertices[i].color = color;
+		}
+		al_draw_prim(vertices, NULL, NULL, 0, style.sides + 2, ALLEGRO_PRIM_TRIANGLE_FAN);
+	}
+
+	if (font) {
+		char text[2] = {style.glyph, '\0'};
+		al_draw_text(font, al_map_rgb(0, 0, 0), centerx, centery - al_get_font_line_height(font) / 2, ALLEGRO_ALIGN_CENTRE, text);
+	}
+}
+
+void shape_catalog::draw_octagon(float centerx, float centery, float scale) {
+	// vertex positions relative to the center of the box
+	int vertex_posx[8] = {0, -14, -20, -14, 0, 14, 20, 14};
+	int vertex_posy[8] = {-20, -14, 0, 14, 20, 14, 0, -14};
+	ALLEGRO_COLOR color = al_map_rgb(255, 0, 0);
+	for (int i = 0; i < 8; i++) {
+		// connect each vertex to the next
+		// when i == 7, connect the first and last vertices
+		float x1 = centerx + vertex_posx[i] * scale;
+		float y1 = centery + vertex_posy[i] * scale;
+		float x2 = centerx + vertex_posx[(i + 1) % 8] * scale;
+		float y2 = centery + vertex_posy[(i + 1) % 8] * scale;
+		al_draw_line(x1, y1, x2, y2, color, 1);
+	}
+}
+
+void shape_catalog::draw_triangle(float centerx, float centery, float scale) {
+	float radius = 20 * scale;
+	ALLEGRO_COLOR color = al_map_rgb(255, 255, 0);
+	al_draw_filled_triangle(centerx, centery - radius, centerx - radius, centery + radius, centerx + radius, centery + radius, color);
+}
+
+void shape_catalog::draw_diamond(float centerx, float centery, float scale) {
+	float base = 18 * scale;
+	float height = 24 * scale;
+	ALLEGRO_COLOR color = al_map_rgb(255, 0, 255);
+	al_draw_filled_triangle(centerx, centery - height, centerx - base, centery, centerx, centery, color);
+	al_draw_filled_triangle(centerx, centery - height, centerx + base, centery, centerx, centery, color);
+	al_draw_filled_triangle(centerx, centery + height, centerx - base, centery, centerx, centery, color);
+	al_draw_filled_triangle(centerx, centery + height, centerx + base, centery, centerx, centery, color);
+}
+
+void shape_catalog::draw_rectangle(float centerx, float centery, float scale) {
+	float width = 30 * scale;
+	float height = 20 * scale;
+	ALLEGRO_COLOR color = al_map_rgb(0, 255, 0);
+	al_draw_filled_rectangle(centerx - width, centery - height, centerx + width, centery + height, color);
+}
+
+void shape_catalog::draw_oval(float centerx, float centery, float scale) {
+	float rx = 30 * scale;
+	float ry = 20 * scale;
+	ALLEGRO_COLOR color = al_map_rgb(0, 255, 255);
+	al_draw_filled_ellipse(centerx, centery, rx, ry, color);
+}
+
+void shape_catalog::draw_circle(float centerx, float centery, float scale) {
+	float radius = 20 * scale;
+	ALLEGRO_COLOR color = al_map_rgb(0, 0, 255);
+	al_draw_filled_circle(centerx, centery, radius, color);
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include <allegro5/allegro_font.h>
+
+// describes how a generated shape looks
+struct shape_style {
+	int sides; // number of sides of the polygon, 0 means an ellipse
+	float rotation; // in radians
+	float stretch; // height / width
+	unsigned char red, green, blue;
+	char glyph; // character drawn in the middle of the shape
+};
+
+/*
+* Maps shape IDs to drawings, so a board isn't limited to the six shapes in shape.h.
+* IDs 1 - 6 are the classic shapes (same order as Shape), designed for the 80 x 80 pixel boxes of the normal board
+* and scaled for other box sizes. Every higher ID gets a generated shape:
+* a polygon or ellipse with its own color and a glyph in the middle.
+* The same ID always produces the same shape, and 252 consecutive IDs never share both their outline and their glyph.
+* logic only places the shapes of Shape on a board, so IDs above 6 can't be reached from a game yet.
+*/
+class shape_catalog {
+public:
+	// number of classic shapes
+	static const int num_classic = 6;
+
+	// returns the style of the generated shape with the given ID
+	// throws an exception if the ID isn't a generated shape (id <= num_classic)
+	static shape_style get_style(int id);
+
+	// draws the shape with the given ID centered at the given location, fitting it in a size x size box
+	// the glyph of a generated shape is drawn with the given font (no glyph if font is NULL)
+	// throws an exception if the ID is out of range (id < 1)
+	static void draw(int id, int centerx, int centery, int size, ALLEGRO_FONT *font);
+private:
+	// box size in pixels the classic shapes were designed for
+	static const int classic_size = 80;
+
+	// draws an octagon centered at the given location, scale 1 fits an 80 x 80 box
+	static void draw_octagon(float centerx, float centery, float scale);
+
+	// draws a triangle centered at the given location, scale 1 fits an 80 x 80 box
+	static void draw_triangle(float centerx, float centery, float scale);
+
+	// draws a diamond centered at the given location, scale 1 fits an 80 x 80 box
+	static void draw_diamond(float centerx, float centery, float scale);
+
+	// draws a rectangle centered at the given location, scale 1 fits an 80 x 80 box
+	static void draw_rectangle(float centerx, float centery, float scale);
+
+	// draws an oval centered at the given location, scale 1 fits an 80 x 80 box
+	static void draw_oval(float centerx, float centery, float scale);
+
+	// draws a circle centered at the given location, scale 1 fits an 80 x 80 box
+	static void draw_circle(float centerx, float centery, float scale);
+};
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "sprite_cache.h"
+#include "shape_catalog.h"
+#include <stdexcept>
+
+sprite_cache::sprite_cache(int capacity, int sprite_size, ALLEGRO_FONT *font) {
+	if (capacity < 1) {
+		throw std::invalid_argument("The sprite cache must hold at least 1 sprite.");
+	}
+	this->capacity = capacity;
+	this->sprite_size = sprite_size;
+	this->font = font;
+	misses = 0;
+
+	// lay the slots out in a roughly square grid
+	int columns = 1;
+	while (columns * columns < capacity) {
+		columns++;
+	}
+	int rows = (capacity + columns - 1) / columns;
+	atlas = al_create_bitmap(columns * sprite_size, rows * sprite_size);
+	if (!atlas) {
+		throw std::runtime_error("Failed to create the sprite atlas.");
+	}
+
+	sprites.resize(capacity);
+	ids.assign(capacity, -1);
+	prev.resize(capacity);
+	next.resize(capacity);
+	for (int slot = 0; slot < capacity; slot++) {
+		sprites[slot] = al_create_sub_bitmap(atlas, (slot % columns) * sprite_size, (slot / columns) * sprite_size, sprite_size, sprite_size);
+		prev[slot] = slot - 1;
+		next[slot] = slot + 1 < capacity ? slot + 1 : -1;
+	}
+	head = 0;
+	tail = capacity - 1;
+
+	// keep the table at most half full so probe sequences stay short
+	int table_size = 1;
+	while (table_size < capacity * 2) {
+		table_size *= 2;
+	}
+	table.assign(table_size, -1);
+	table_mask = table_size - 1;
+}
+
+sprite_cache::~sprite_cache() {
+	for (int slot = 0; slot < capacity; slot++) {
+		al_destroy_bitmap(sprites[slot]);
+	}
+	al_destroy_bitmap(atlas);
+}
+
+int sprite_cache::get_capacity() {
+	return capacity;
+}
+
+int sprite_cache::get_misses() {
+	return misses;
+}
+
+ALLEGRO_BITMAP *sprite_cache::get(int id) {
+	if (id < 1) {
+		throw std::invalid_argument("Shape ID out of range!");
+	}
+
+	int pos = find(id);
+	if (table[pos] != -1) {
+		touch(table[pos]);
+		return sprites[table[pos]];
+	}
+
+	// reuse the least recently used slot
+	misses++;
+	int slot = tail;
+	if (ids[slot] != -1) {
+		erase(find(ids[slot]));
+		// erasing can move entries around
+		pos = find(id);
+	}
+	ids[slot] = id;
+	table[pos] = slot;
+	touch(slot);
+
+	// rasterize the shape into its slot
+	ALLEGRO_BITMAP *previous_target = al_get_target_bitmap();
+	al_set_target_bitmap(sprites[slot]);
+	al_clear_to_color(al_map_rgba(0, 0, 0, 0));
+	shape_catalog::draw(id, sprite_size / 2, sprite_size / 2, sprite_size, font);
+	al_set_target_bitmap(previous_target);
+	return sprites[slot];
+}
+
+void sprite_cache::draw(int id, int centerx, int centery) {
+	al_draw_bitmap(get(id), centerx - sprite_size / 2, centery - sprite_size / 2, 0);
+}
+
+int sprite_cache::home(int id) {
+	unsigned int hash = id * 2654435761u;
+	hash ^= hash >> 16;
+	return hash & table_mask;
+}
+
+int sprite_cache::find(int id) {
+	int pos = home(id);
+	while (table[pos] != -1 && ids[table[pos]] != id) {
+		pos = (pos + 1) & table_mask;
+	}
+	return pos;
+}
+
+void sprite_cache::erase(int pos) {
+	table[pos] = -1;
+	// shift later entries of the probe sequence back into the hole, so lookups don't stop early
+	int hole = pos;
+	int next_pos = pos;
+	while (true) {
+		next_pos = (next_pos + 1) & table_mask;
+		if (table[next_pos] == -1) {
+			return;
+		}
+		int ideal = home(ids[table[next_pos]]);
+		// the entry can move if its ideal position isn't cyclically between the hole and where it is now
+		bool between = hole <= next_pos ? (ideal > hole && ideal <= next_pos) : (ideal > hole || ideal <= next_pos);
+		if (!between) {
+			table[hole] = table[next_pos];
+			table[next_pos] = -1;
+			hole = next_pos;
+		}
+	}
+}
+
+void sprite_cache::touch(int slot) {
+	if (head == slot) {
+		return;
+	}
+	// unlink the slot
+	next[prev[slot]] = next[slot];
+	if (next[slot] != -1) {
+		prev[next[slot]] = prev[slot];
+	}
+	else {
+		tail = prev[slot];
+	}
+	// and put it in front
+	prev[slot] = -1;
+	next[slot] = head;
+	prev[head] = slot;
+	head = slot;
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_font.h>
+#include <vector>
+
+/*
+* Keeps rasterized shapes (see shape_catalog) in one atlas bitmap, so revealing a shape is a single blit.
+* The atlas has a fixed number of slots; when every slot is in use, the least recently used sprite is replaced.
+* Memory use is fixed at construction no matter how many different shapes are drawn, and lookups don't allocate.
+*/
+class sprite_cache {
+public:
+	// creates a cache with room for capacity sprites of sprite_size x sprite_size pixels
+	// glyphs of generated shapes are drawn with the given font
+	// must be called after the display has been created
+	// throws an exception if capacity < 1 or the atlas can't be created
+	sprite_cache(int capacity, int sprite_size, ALLEGRO_FONT *font);
+
+	// destroys the atlas
+	~sprite_cache();
+
+	// returns the number of sprites the cache can hold
+	int get_capacity();
+
+	// returns the number of times a sprite had to be rasterized
+	int get_misses();
+
+	// returns the sprite of the shape with the given ID, rasterizing it first if it isn't cached
+	// the sprite is a sub-bitmap of the atlas and stays valid until it's replaced by another shape
+	// throws an exception if the ID is out of range (id < 1)
+	ALLEGRO_BITMAP *get(int id);
+
+	// draws the shape with the given ID centered at the given location
+	// throws an exception if the ID is out of range (id < 1)
+	void draw(int id, int centerx, int centery);
+private:
+	// returns the hash table position the given ID would ideally be stored at
+	int home(int id);
+
+	// returns the position in the hash table where the given ID is or would be stored
+	int find(int id);
+
+	// removes the slot stored at the given hash table position, keeping probe sequences intact
+	void erase(int pos);
+
+	// moves the given slot to the front of the recently used list
+	void touch(int slot);
+
+	int capacity;
+	int sprite_size;
+	int misses;
+	ALLEGRO_FONT *font;
+	ALLEGRO_BITMAP *atlas;
+	std::vector<ALLEGRO_BITMAP *> sprites; // one sub-bitmap of the atlas per slot
+	std::vector<int> ids; // shape ID in each slot, -1 if the slot is empty
+
+	// recently used list, a doubly linked list of slots (most recent first)
+	std::vector<int> prev, next;
+	int head, tail;
+
+	// open addressing hash table from shape ID to slot, -1 marks a free position
+	std::vector<int> table;
+	int table_mask; // table size - 1, the size is a power of two
+};
\ No newline at end of file
@@ -0,0 +1,180 @@
+#include "tournament.h"
+#include "vec_env.h"
+#include "board.h"
+#include "shape_catalog.h"
+#include <math.h>
+
+tournament_view::tournament_view(int num_boards, int width, int height, unsigned int seed) {
+	if (num_boards < 1) {
+		throw std::invalid_argument("The number of boards must be at least 1.");
+	}
+	this->num_boards = num_boards;
+	board board;
+	cells = board.get_size();
+
+	// pick the grid that makes the boards as big as possible
+	board_size = 0;
+	for (int c = 1; c <= num_boards; c++) {
+		int rows = (num_boards + c - 1) / c;
+		float size = fminf(static_cast<float>(width) / c, static_cast<float>(height) / rows);
+		if (size > board_size) {
+			board_size = size;
+			columns = c;
+		}
+	}
+	spacing = board_size;
+	// leave a gap between boards
+	board_size = floorf(spacing * 0.92f);
+	// the atlas is drawn at the size the boxes are shown at, so the thin lines of the 'X' mark and the octagon survive
+	box_size = static_cast<int>(ceilf(board_size / cells));
+
+	games.reset(new vec_env(num_boards, 1));
+	seeds.resize(num_boards);
+	actions.resize(num_boards);
+	rng = seed | 1;
+	for (int i = 0; i < num_boards; i++) {
+		seeds[i] = seed + i;
+	}
+
+	atlas = NULL;
+	grid_buffer = NULL;
+	create_atlas();
+	create_grid();
+	new_round();
+
+	// blit every box once so Allegro's buffer for held drawing reaches its full size before play starts
+	al_hold_bitmap_drawing(true);
+	for (int i = 0; i < num_boards * vec_env::num_cells; i++) {
+		al_draw_bitmap_region(atlas, 0, 0, box_size, box_size, 0, 0, 0);
+	}
+	al_hold_bitmap_drawing(false);
+}
+
+tournament_view::~tournament_view() {
+	if (grid_buffer) {
+		al_destroy_vertex_buffer(grid_buffer);
+	}
+	if (atlas) {
+		al_destroy_bitmap(atlas);
+	}
+}
+
+int tournament_view::get_num_boards() {
+	return num_boards;
+}
+
+void tournament_view::create_atlas() {
+	// slot 0 is the 'X' mark, slots 1 - 6 are the shapes in Shape order
+	atlas = al_create_bitmap(7 * box_size, box_size);
+	if (!atlas) {
+		throw std::runtime_error("Failed to create the shape atlas.");
+	}
+	ALLEGRO_BITMAP *previous_target = al_get_target_bitmap();
+	al_set_target_bitmap(atlas);
+	al_clear_to_color(al_map_rgba(0, 0, 0, 0));
+	al_draw_line(0, 0, box_size, box_size, al_map_rgb(255, 255, 255), 1);
+	al_draw_line(box_size, 0, 0, box_size, al_map_rgb(255, 255, 255), 1);
+	for (int id = 1; id <= shape_catalog::num_classic; id++) {
+		shape_catalog::draw(id, box_size * id + box_size / 2, box_size / 2, box_size, NULL);
+	}
+	al_set_target_bitmap(previous_target);
+}
+
+void tournament_view::create_grid() {
+	ALLEGRO_COLOR color = al_map_rgb(255, 255, 255);
+	float box = board_size / cells;
+	for (int i = 0; i < num_boards; i++) {
+		float left = (i % columns) * spacing + 1;
+		float top = (i / columns) * spacing + 1;
+		for (int j = 0; j < cells + 1; j++) {
+			// vertical line
+			ALLEGRO_VERTEX v = {left + j * box, top, 0, 0, 0, color};
+			grid.push_back(v);
+			v.y = top + board_size;
+			grid.push_back(v);
+			// horizontal line
+			v.x = left;
+			v.y = top + j * box;
+			grid.push_back(v);
+			v.x = left + board_size;
+			grid.push_back(v);
+		}
+	}
+	// fall back to drawing from memory if vertex buffers aren't supported
+	grid_buffer = al_create_vertex_buffer(NULL, grid.data(), grid.size(), ALLEGRO_PRIM_BUFFER_STATIC);
+}
+
+void tournament_view::new_round() {
+	for (int i = 0; i < num_boards; i++) {
+		seeds[i] += num_boards;
+	}
+	games->reset(seeds.data());
+}
+
+void tournament_view::step() {
+	const int8_t *observations = games->get_observations();
+	const uint8_t *dones = games->get_dones();
+	bool round_over = true;
+	for (int i = 0; i < num_boards; i++) {
+		if (!dones[i]) {
+			round_over = false;
+		}
+		// the bots click a random face down box
+		const int8_t *obs = &observations[i * vec_env::num_cells];
+		int face_down = 0;
+		for (int cell = 0; cell < vec_env::num_cells; cell++) {
+			if (obs[cell] == 0) {
+				face_down++;
+			}
+		}
+		actions[i] = -1;
+		if (face_down > 0) {
+			rng ^= rng << 13;
+			rng ^= rng >> 17;
+			rng ^= rng << 5;
+			int pick = rng % face_down;
+			for (int cell = 0; cell < vec_env::num_cells; cell++) {
+				if (obs[cell] == 0 && pick-- == 0) {
+					actions[i] = cell;
+					break;
+				}
+			}
+		}
+	}
+
+	if (round_over) {
+		new_round();
+	}
+	else {
+		games->step(actions.data());
+	}
+}
+
+void tournament_view::draw() {
+	if (grid_buffer) {
+		al_draw_vertex_buffer(grid_buffer, NULL, 0, grid.size(), ALLEGRO_PRIM_LINE_LIST);
+	}
+	else {
+		al_draw_prim(grid.data(), NULL, NULL, 0, grid.size(), ALLEGRO_PRIM_LINE_LIST);
+	}
+
+	// every blit comes from the atlas, so holding drawing turns them into one draw call
+	const int8_t *observations = games->get_observations();
+	float box = board_size / cells;
+	al_hold_bitmap_drawing(true);
+	for (int i = 0; i < num_boards; i++) {
+		float left = (i % columns) * spacing + 1;
+		float top = (i / columns) * spacing + 1;
+		const int8_t *obs = &observations[i * vec_env::num_cells];
+		for (int cell = 0; cell < vec_env::num_cells; cell++) {
+			if (obs[cell] != 0) {
+				// -1 (gone) maps to the 'X' mark in slot 0
+				int slot = obs[cell] < 0 ? 0 : obs[cell];
+				float x = left + (cell % cells) * box;
+				float y = top + (cell / cells) * box;
+				al_draw_bitmap_region(atlas, slot * box_size, 0, box_size, box_size, x, y, 0);
+			}
+		}
+	}
+	al_hold_bitmap_drawing(false);
+}
\ No newline at end of file
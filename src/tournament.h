@@ -0,0 +1,60 @@
+#include <allegro5/allegro.h>
+#include <allegro5/allegro_primitives.h>
+#include <vector>
+#include <memory>
+
+class vec_env;
+
+/*
+* Shows many live games side by side in one window, e.g. for bot tournaments.
+* The games are played by random bots through vec_env. When every game of a round is over, a new round starts.
+*
+* Drawing is batched: the grid lines of all boards live in one static vertex buffer,
+* and every revealed shape is a blit from one shape atlas while bitmap drawing is held,
+* so a frame takes two draw calls no matter how many boards are shown.
+*/
+class tournament_view {
+public:
+	// lays out num_boards scaled boards in a grid that fills a width x height area
+	// the bots' random number generators and the boards are derived from the given seed
+	// must be called after the display has been created
+	// throws an exception if num_boards < 1 or the shape atlas can't be created
+	tournament_view(int num_boards, int width, int height, unsigned int seed);
+
+	// destroys the games, the shape atlas and the vertex buffer
+	~tournament_view();
+
+	// returns the number of boards
+	int get_num_boards();
+
+	// makes every bot click once, and starts a new round if every game is over
+	void step();
+
+	// draws every board to the current target bitmap
+	void draw();
+private:
+	// draws every shape and the 'X' mark into the atlas, one box-sized slot each
+	void create_atlas();
+
+	// builds the grid lines of every board into the vertex buffer
+	void create_grid();
+
+	// starts a new round on every board
+	void new_round();
+
+	int num_boards;
+	int columns; // boards per row
+	float board_size; // size of a scaled board in pixels
+	float spacing; // distance between the top left corners of neighboring boards
+	int box_size; // size of a box in the atlas, in pixels (the size of a box on a scaled board, rounded up)
+	int cells; // boxes per board row
+
+	std::unique_ptr<vec_env> games;
+	std::vector<unsigned int> seeds; // board seeds for the current round
+	std::vector<int> actions; // the bots' clicks for the next step
+	unsigned int rng; // xorshift32 state for the bots
+
+	ALLEGRO_BITMAP *atlas; // every shape side by side, slot 0 is the 'X' mark
+	std::vector<ALLEGRO_VERTEX> grid; // grid lines of every board
+	ALLEGRO_VERTEX_BUFFER *grid_buffer; // the same lines on the GPU, NULL if vertex buffers aren't supported
+};
\ No newline at end of file
@@ -0,0 +1,235 @@
+#include "vec_env.h"
+#include "vec_env_c.h"
+
+vec_env::vec_env(int num_envs, int num_threads) {
+	if (num_envs < 1) {
+		throw std::invalid_argument("The number of environments must be at least 1.");
+	}
+	if (num_threads < 0) {
+		throw std::invalid_argument("The number of threads can't be negative.");
+	}
+	if (num_threads == 0) {
+		num_threads = std::thread::hardware_concurrency();
+		if (num_threads == 0) {
+			num_threads = 1;
+		}
+	}
+	this->num_envs = num_envs;
+	num_slices = num_threads < num_envs ? num_threads : num_envs;
+	games.resize(num_envs);
+	states.resize(num_envs);
+	observations.assign(num_envs * num_cells, 0);
+	rewards.assign(num_envs, 0);
+	// no game has been set up yet, so every game is done until the first reset
+	dones.assign(num_envs, 1);
+	job_seeds = NULL;
+	job_actions = NULL;
+
+	current_job = job::none;
+	job_number = 0;
+	busy_workers = 0;
+	// the calling thread handles slice 0
+	for (int slice = 1; slice < num_slices; slice++) {
+		workers.push_back(std::thread(&vec_env::worker, this, slice));
+	}
+}
+
+vec_env::~vec_env() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		current_job = job::quit;
+		job_number++;
+	}
+	job_ready.notify_all();
+	for (size_t i = 0; i < workers.size(); i++) {
+		workers[i].join();
+	}
+}
+
+int vec_env::get_num_envs() {
+	return num_envs;
+}
+
+void vec_env::reset(const unsigned int *seeds) {
+	job_seeds = seeds;
+	run(job::reset);
+}
+
+void vec_env::step(const int *actions) {
+	job_actions = actions;
+	run(job::step);
+}
+
+const int8_t *vec_env::get_observations() {
+	return observations.data();
+}
+
+const float *vec_env::get_rewards() {
+	return rewards.data();
+}
+
+const uint8_t *vec_env::get_dones() {
+	return dones.data();
+}
+
+void vec_env::reset_range(int begin, int end) {
+	for (int i = begin; i < end; i++) {
+		games[i].reset();
+		games[i].random_create(12, job_seeds[i]);
+		states[i].first = -1;
+		states[i].hide[0] = -1;
+		states[i].hide[1] = -1;
+		states[i].pairs_matched = 0;
+		for (int cell = 0; cell < num_cells; cell++) {
+			observations[i * num_cells + cell] = 0;
+		}
+		rewards[i] = 0;
+		dones[i] = 0;
+	}
+}
+
+void vec_env::step_range(int begin, int end) {
+	for (int i = begin; i < end; i++) {
+		logic &game_logic = games[i];
+		game_state &state = states[i];
+		int8_t *obs = &observations[i * num_cells];
+		rewards[i] = 0;
+		if (dones[i]) {
+			continue;
+		}
+
+		// turn the pair that didn't match in the last step face down again
+		if (state.hide[0] >= 0) {
+			for (int j = 0; j < 2; j++) {
+				game_logic.set_played(state.hide[j] % 5, state.hide[j] / 5, false);
+				obs[state.hide[j]] = 0;
+				state.hide[j] = -1;
+			}
+		}
+
+		int action = job_actions[i];
+		if (action < 0 || action >= num_cells) {
+			continue;
+		}
+		int x = action % 5;
+		int y = action / 5;
+		if (!game_logic.is_playable(x, y)) {
+			continue;
+		}
+		game_logic.set_played(x, y, true);
+		Shape shape = game_logic.get_shape(x, y);
+		// an empty box stays unplayable
+		if (shape == Shape::null) {
+			obs[action] = -1;
+			continue;
+		}
+		obs[action] = static_cast<int8_t>(shape);
+
+		// first shape was selected
+		if (state.first < 0) {
+			state.first = action;
+			continue;
+		}
+		// second shape was selected
+		if (game_logic.compare(x, y, game_logic.get_shape(state.first % 5, state.first / 5))) {
+			state.pairs_matched++;
+			rewards[i] = 1;
+			obs[state.first] = -1;
+			obs[action] = -1;
+			dones[i] = game_logic.done(state.pairs_matched);
+		}
+		else {
+			state.hide[0] = state.first;
+			state.hide[1] = action;
+		}
+		state.first = -1;
+	}
+}
+
+void vec_env::run(job work) {
+	if (num_slices > 1) {
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			current_job = work;
+			job_number++;
+			busy_workers = num_slices - 1;
+		}
+		job_ready.notify_all();
+	}
+
+	if (work == job::reset) {
+		reset_range(0, num_envs / num_slices);
+	}
+	else if (work == job::step) {
+		step_range(0, num_envs / num_slices);
+	}
+
+	if (num_slices > 1) {
+		std::unique_lock<std::mutex> guard(lock);
+		job_done.wait(guard, [this] { return busy_workers == 0; });
+	}
+}
+
+void vec_env::worker(int slice) {
+	int begin = static_cast<long long>(num_envs) * slice / num_slices;
+	int end = static_cast<long long>(num_envs) * (slice + 1) / num_slices;
+	unsigned long last_job = 0;
+	while (true) {
+		job work;
+		{
+			std::unique_lock<std::mutex> guard(lock);
+			job_ready.wait(guard, [this, last_job] { return job_number != last_job; });
+			last_job = job_number;
+			work = current_job;
+		}
+		if (work == job::quit) {
+			return;
+		}
+		if (work == job::reset) {
+			reset_range(begin, end);
+		}
+		else if (work == job::step) {
+			step_range(begin, end);
+		}
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			busy_workers--;
+			if (busy_workers == 0) {
+				job_done.notify_one();
+			}
+		}
+	}
+}
+
+vec_env *vec_env_create(int num_envs, int num_threads) {
+	try {
+		return new vec_env(num_envs, num_threads);
+	}
+	catch (std::exception &e) {
+		return NULL;
+	}
+}
+
+void vec_env_destroy(vec_env *env) {
+	delete env;
+}
+
+void vec_env_reset(vec_env *env, const unsigned int *seeds) {
+	env->reset(seeds);
+}
+
+void vec_env_step(vec_env *env, const int *actions) {
+	env->step(actions);
+}
+
+const int8_t *vec_env_observations(vec_env *env) {
+	return env->get_observations();
+}
+
+const float *vec_env_rewards(vec_env *env) {
+	return env->get_rewards();
+}
+
+const uint8_t *vec_env_dones(vec_env *env) {
+	return env->get_dones();
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "logic.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stdint.h>
+
+/*
+* A "vector environment" for training agents: N independent games that are stepped together, without Allegro.
+* Each step takes one action per game and writes observations, rewards and dones into contiguous buffers
+* owned by the environment, which callers read in place. Games are split across a pool of worker threads.
+*
+* An action is the board index of the box to click (y * 5 + x).
+* Observations hold 25 values per game, in board index order:
+*  0 = face down (playable)
+* >0 = face up, the value is the shape (see shape.h)
+* -1 = gone (matched, or an empty box that was clicked)
+* A mismatched pair stays face up for one step so the agent can see it, then it's turned face down again.
+* The reward is 1 for matching a pair and 0 otherwise. Clicking an unplayable box or an out-of-range index does nothing.
+* A game that is done ignores its actions until the next reset.
+*/
+class vec_env {
+public:
+	// number of observation values per game
+	static const int num_cells = 25;
+
+	// creates num_envs games processed by num_threads threads (including the calling thread)
+	// num_threads == 0 uses one thread per CPU core
+	// throws an exception if num_envs < 1 or num_threads < 0
+	vec_env(int num_envs, int num_threads);
+
+	// stops the worker threads
+	~vec_env();
+
+	// returns the number of games
+	int get_num_envs();
+
+	// starts a new game in every environment, game i's board is generated from seeds[i]
+	// seeds must hold num_envs values
+	void reset(const unsigned int *seeds);
+
+	// clicks actions[i] in game i
+	// actions must hold num_envs values
+	void step(const int *actions);
+
+	// returns the observation buffer (num_envs * num_cells values)
+	const int8_t *get_observations();
+
+	// returns the reward buffer (num_envs values), rewards earned in the last step
+	const float *get_rewards();
+
+	// returns the done buffer (num_envs values), 1 if the game is over and 0 if not
+	const uint8_t *get_dones();
+private:
+	// per-game state outside of logic
+	struct game_state {
+		int first; // board index of the first shape of the current pair, -1 if none
+		int hide[2]; // board indexes of a mismatched pair to turn face down on the next step, -1 if none
+		int pairs_matched;
+	};
+
+	// what the worker threads are asked to do
+	enum class job { none, reset, step, quit };
+
+	// resets games [begin, end)
+	void reset_range(int begin, int end);
+
+	// steps games [begin, end)
+	void step_range(int begin, int end);
+
+	// runs the given job over all games, split across the worker threads and the calling thread
+	void run(job work);
+
+	// worker thread loop, handles the given slice of the games
+	void worker(int slice);
+
+	int num_envs;
+	int num_slices; // number of parts the games are split into, one per thread
+	std::vector<logic> games;
+	std::vector<game_state> states;
+	std::vector<int8_t> observations;
+	std::vector<float> rewards;
+	std::vector<uint8_t> dones;
+
+	// arguments of the current job
+	const unsigned int *job_seeds;
+	const int *job_actions;
+
+	// thread pool
+	std::vector<std::thread> workers;
+	std::mutex lock;
+	std::condition_variable job_ready; // signaled when a new job is posted
+	std::condition_variable job_done; // signaled when the last worker finishes a job
+	job current_job;
+	unsigned long job_number; // incremented for every job so workers can tell a new one apart
+	int busy_workers; // workers that haven't finished the current job yet
+};
\ No newline at end of file
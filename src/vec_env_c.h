@@ -0,0 +1,38 @@
+/*
+* C interface to vec_env (see vec_env.h), for C programs and for foreign function interfaces such as Python's ctypes.
+* An environment is an opaque pointer; the buffers it returns are laid out as described in vec_env.h.
+*/
+#ifndef VEC_ENV_C_H
+#define VEC_ENV_C_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+class vec_env;
+extern "C" {
+#else
+typedef struct vec_env vec_env;
+#endif
+
+// creates num_envs games processed by num_threads threads, returns NULL if the environment can't be created
+vec_env *vec_env_create(int num_envs, int num_threads);
+
+// stops the worker threads and frees the environment
+void vec_env_destroy(vec_env *env);
+
+// starts a new game in every environment, seeds must hold num_envs values
+void vec_env_reset(vec_env *env, const unsigned int *seeds);
+
+// clicks actions[i] in game i, actions must hold num_envs values
+void vec_env_step(vec_env *env, const int *actions);
+
+// return the observation, reward and done buffers
+const int8_t *vec_env_observations(vec_env *env);
+const float *vec_env_rewards(vec_env *env);
+const uint8_t *vec_env_dones(vec_env *env);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif